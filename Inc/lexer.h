@@ -3,7 +3,7 @@
 
 extern int  getNextTok(void);
 extern std::string getTokStr(void);
-extern int getTokNumVal(void);
+extern long long getTokNumVal(void);
 
 enum Token {
     tok_begin = -1,
@@ -19,29 +19,32 @@ enum Token {
     tok_odd = -11,
     tok_write = -12,
     tok_writeln = -13,
+    tok_read = -14,
 
-    tok_plus = -14,
-    tok_minus = -15,
-    tok_mult = -16,
-    tok_div = -17,
-    tok_lparen = -18,
-    tok_rparen = -19,
-    tok_equal = -20,
-    tok_less = -21,
-    tok_greater = -22,
-    tok_notequal = -23,
-    tok_lessequal = -24,
-    tok_greaterequal = -25,
-    tok_comma = -26,
-    tok_period = -27,
-    tok_semicolon = -28,
-    tok_assign = -29,
+    tok_plus = -15,
+    tok_minus = -16,
+    tok_mult = -17,
+    tok_div = -18,
+    tok_lparen = -19,
+    tok_rparen = -20,
+    tok_lbracket = -21,
+    tok_rbracket = -22,
+    tok_equal = -23,
+    tok_less = -24,
+    tok_greater = -25,
+    tok_notequal = -26,
+    tok_lessequal = -27,
+    tok_greaterequal = -28,
+    tok_comma = -29,
+    tok_period = -30,
+    tok_semicolon = -31,
+    tok_assign = -32,
 
-    tok_id = -30,
-    tok_num = -31,
+    tok_id = -33,
+    tok_num = -34,
 
-    tok_eof = -32,
-    tok_none = -33
+    tok_eof = -35,
+    tok_none = -36
 };
 
 #endif
\ No newline at end of file
@@ -7,13 +7,45 @@ enum {
   CONST = 0,
   VAR = 1,
   FUNC = 2,
-  MAX_SYMBOL_TYPE = 3
+  ARRAY = 3,
+  MAX_SYMBOL_TYPE = 4
+};
+
+/// ASTKind - Tag identifying the concrete class of an AST node.
+enum ASTKind {
+  ast_program,
+  ast_block,
+  ast_decl_list,
+  ast_decl,
+  ast_const_decl,
+  ast_number_list,
+  ast_var_decl,
+  ast_ident_list,
+  ast_opt_par_list,
+  ast_par_list,
+  ast_func_decl,
+  ast_statement,
+  ast_state_list,
+  ast_condition,
+  ast_expression,
+  ast_term_list,
+  ast_term,
+  ast_fact_list,
+  ast_factor,
+  ast_exp_list
 };
 
 /// AST - Base class for all expression nodes.
+/// The destructor is the only virtual member; passes dispatch on getKind()
+/// through ASTVisitor (visitor.h) instead of virtual calls.
 class AST {
+  const ASTKind Kind;
+
 public:
+  AST(ASTKind Kind) : Kind(Kind) {}
   virtual ~AST() = default;
+
+  ASTKind getKind() const { return Kind; }
 };
 
 /// ProgramAST
@@ -22,7 +54,10 @@ class ProgramAST : public AST {
   std::unique_ptr<AST>  block;
 
 public:
-  ProgramAST(std::unique_ptr<AST> block) : block(std::move(block)) {}
+  ProgramAST(std::unique_ptr<AST> block)
+    : AST(ast_program), block(std::move(block)) {}
+
+  AST* getBlock() const { return block.get(); }
 };
 
 /// BlockAST
@@ -32,7 +67,11 @@ class BlockAST : public AST {
 
 public:
   BlockAST(std::unique_ptr<AST> declList,std::unique_ptr<AST> statement)
-    : declList(std::move(declList)), statement(std::move(statement)) {}
+    : AST(ast_block), declList(std::move(declList)),
+    statement(std::move(statement)) {}
+
+  AST* getDeclList() const { return declList.get(); }
+  AST* getStatement() const { return statement.get(); }
 };
 
 /// DeclListAST
@@ -43,7 +82,11 @@ class DeclListAST : public AST {
   std::vector<std::unique_ptr<AST>>  declList;
 public:
   DeclListAST(std::vector<std::unique_ptr<AST>> declList)
-    : declList(std::move(declList)) {}
+    : AST(ast_decl_list), declList(std::move(declList)) {}
+
+  const std::vector<std::unique_ptr<AST>>& getDeclList() const {
+    return declList;
+  }
 };
 
 /// DeclAST
@@ -56,7 +99,9 @@ class DeclAST : public AST {
 
 public:
   DeclAST(std::unique_ptr<AST> decl)
-    : decl(std::move(decl)) {}
+    : AST(ast_decl), decl(std::move(decl)) {}
+
+  AST* getDecl() const { return decl.get(); }
 };
 
 /// ConstDeclAST
@@ -66,7 +111,9 @@ class ConstDeclAST : public AST {
 
 public:
   ConstDeclAST(std::unique_ptr<AST> numberList)
-    : numberList(std::move(numberList)) {}
+    : AST(ast_const_decl), numberList(std::move(numberList)) {}
+
+  AST* getNumberList() const { return numberList.get(); }
 };
 
 /// NumberListAST
@@ -74,11 +121,15 @@ public:
 ///    ::= IDENT EQ NUMBER
 ///    ::= numberList COMMA IDENT EQ NUMBER
 class NumberListAST : public AST {
-  std::vector<std::pair<std::string,int>> numberList;
+  std::vector<std::pair<std::string,long long>> numberList;
 
 public:
-  NumberListAST(std::vector<std::pair<std::string,int>> numberList)
-    : numberList(std::move(numberList)) {}
+  NumberListAST(std::vector<std::pair<std::string,long long>> numberList)
+    : AST(ast_number_list), numberList(std::move(numberList)) {}
+
+  const std::vector<std::pair<std::string,long long>>& getNumberList() const {
+    return numberList;
+  }
 };
 
 /// VarDeclAST
@@ -88,19 +139,29 @@ class VarDeclAST : public AST {
 
 public:
   VarDeclAST(std::unique_ptr<AST> identList)
-    : identList(std::move(identList)) {}
+    : AST(ast_var_decl), identList(std::move(identList)) {}
+
+  AST* getIdentList() const { return identList.get(); }
 };
 
 /// IdentListAST
 /// identList
+///    ::= ident
+///    ::= identList COMMA ident
+/// ident
 ///    ::= IDENT
-///    ::= identList COMMA IDENT
+///    ::= IDENT '[' NUMBER ']'
+/// A scalar variable is stored with size 0.
 class IdentListAST : public AST {
-  std::vector<std::string>  identList;
+  std::vector<std::pair<std::string,int>>  identList;
 
 public:
-  IdentListAST(std::vector<std::string> identList)
-    : identList(std::move(identList)) {}
+  IdentListAST(std::vector<std::pair<std::string,int>> identList)
+    : AST(ast_ident_list), identList(std::move(identList)) {}
+
+  const std::vector<std::pair<std::string,int>>& getIdentList() const {
+    return identList;
+  }
 };
 
 /// OptParListAST
@@ -112,7 +173,9 @@ class OptParListAST : public AST {
 
 public:
   OptParListAST(std::unique_ptr<AST> parList)
-    : parList(std::move(parList)) {}
+    : AST(ast_opt_par_list), parList(std::move(parList)) {}
+
+  AST* getParList() const { return parList.get(); }
 };
 
 /// ParListAST
@@ -124,7 +187,9 @@ class ParListAST : public AST {
 
 public:
   ParListAST(std::vector<std::string> parList)
-    : parList(std::move(parList)) {}
+    : AST(ast_par_list), parList(std::move(parList)) {}
+
+  const std::vector<std::string>& getParList() const { return parList; }
 };
 
 /// FuncDeclAST
@@ -135,20 +200,26 @@ class FuncDeclAST : public AST {
 
 public:
   FuncDeclAST(std::string Name,std::unique_ptr<AST> optParList,
-    std::unique_ptr<AST> block) : Name(Name),
+    std::unique_ptr<AST> block) : AST(ast_func_decl), Name(Name),
     optParList(std::move(optParList)), block(std::move(block)) {}
+
+  const std::string& getName() const { return Name; }
+  AST* getOptParList() const { return optParList.get(); }
+  AST* getBlock() const { return block.get(); }
 };
 
 /// StatementAST
 /// statement
 ///    ::= <empty>
 ///    ::= IDENT COLOEQ expression
+///    ::= IDENT '[' expression ']' COLOEQ expression
 ///    ::= BEGINN statement stateList END
 ///    ::= IF condition THEN statement
 ///    ::= WHILE condition DO statement
 ///    ::= RETURN expression
 ///    ::= WRITE expression
 ///    ::= WRITELN
+///    ::= READ IDENT
 class StatementAST : public AST {
   int head_tok;
   std::string Name;
@@ -156,13 +227,24 @@ class StatementAST : public AST {
   std::unique_ptr<AST> condition;
   std::unique_ptr<AST> statement;
   std::unique_ptr<AST> stateList;
+  std::unique_ptr<AST> index;
 
 public:
   StatementAST(int head_tok,std::string Name,std::unique_ptr<AST> expression,
     std::unique_ptr<AST> condition,std::unique_ptr<AST> statement,
-    std::unique_ptr<AST> stateList) : head_tok(head_tok),Name(Name),
+    std::unique_ptr<AST> stateList,std::unique_ptr<AST> index = nullptr)
+    : AST(ast_statement), head_tok(head_tok),Name(Name),
     expression(std::move(expression)),condition(std::move(condition)),
-    statement(std::move(statement)),stateList(std::move(stateList)) {}
+    statement(std::move(statement)),stateList(std::move(stateList)),
+    index(std::move(index)) {}
+
+  int getHeadTok() const { return head_tok; }
+  const std::string& getName() const { return Name; }
+  AST* getExpression() const { return expression.get(); }
+  AST* getCondition() const { return condition.get(); }
+  AST* getStatement() const { return statement.get(); }
+  AST* getStateList() const { return stateList.get(); }
+  AST* getIndex() const { return index.get(); }
 };
 
 /// StateListAST
@@ -174,8 +256,11 @@ class StateListAST : public AST {
 
 public:
   StateListAST(std::unique_ptr<AST> stateList,
-    std::unique_ptr<AST> statement) : stateList(std::move(stateList)),
-    statement(std::move(statement)) {}
+    std::unique_ptr<AST> statement) : AST(ast_state_list),
+    stateList(std::move(stateList)),statement(std::move(statement)) {}
+
+  AST* getStateList() const { return stateList.get(); }
+  AST* getStatement() const { return statement.get(); }
 };
 
 /// ConditionAST
@@ -193,8 +278,12 @@ class ConditionAST : public AST {
 
 public:
   ConditionAST(int op_tok,std::unique_ptr<AST> LHS,
-    std::unique_ptr<AST> RHS) : op_tok(op_tok),
+    std::unique_ptr<AST> RHS) : AST(ast_condition), op_tok(op_tok),
     LHS(std::move(LHS)),RHS(std::move(RHS)) {}
+
+  int getOpTok() const { return op_tok; }
+  AST* getLHS() const { return LHS.get(); }
+  AST* getRHS() const { return RHS.get(); }
 };
 
 /// ExpressionAST
@@ -207,8 +296,12 @@ class ExpressionAST : public AST {
 
 public:
   ExpressionAST(int head_tok,std::unique_ptr<AST> term,
-    std::unique_ptr<AST> termList) : head_tok(head_tok),
+    std::unique_ptr<AST> termList) : AST(ast_expression), head_tok(head_tok),
     term(std::move(term)),termList(std::move(termList)) {}
+
+  int getHeadTok() const { return head_tok; }
+  AST* getTerm() const { return term.get(); }
+  AST* getTermList() const { return termList.get(); }
 };
 
 /// TermListAST
@@ -222,8 +315,12 @@ class TermListAST : public AST {
 
 public:
   TermListAST(int op_tok,std::unique_ptr<AST> term,
-    std::unique_ptr<AST> termList) : op_tok(op_tok),
+    std::unique_ptr<AST> termList) : AST(ast_term_list), op_tok(op_tok),
     term(std::move(term)),termList(std::move(termList)) {}
+
+  int getOpTok() const { return op_tok; }
+  AST* getTerm() const { return term.get(); }
+  AST* getTermList() const { return termList.get(); }
 };
 
 /// TermAST
@@ -233,7 +330,10 @@ class TermAST : public AST {
 
 public:
   TermAST(std::unique_ptr<AST> factor,std::unique_ptr<AST> factList)
-    : factor(std::move(factor)),factList(std::move(factList)) {}
+    : AST(ast_term), factor(std::move(factor)),factList(std::move(factList)) {}
+
+  AST* getFactor() const { return factor.get(); }
+  AST* getFactList() const { return factList.get(); }
 };
 
 /// FactListAST
@@ -247,8 +347,12 @@ class FactListAST : public AST {
 
 public:
   FactListAST(int op_tok,std::unique_ptr<AST> factor,
-    std::unique_ptr<AST> factList) : op_tok(op_tok),
+    std::unique_ptr<AST> factList) : AST(ast_fact_list), op_tok(op_tok),
     factor(std::move(factor)),factList(std::move(factList)) {}
+
+  int getOpTok() const { return op_tok; }
+  AST* getFactor() const { return factor.get(); }
+  AST* getFactList() const { return factList.get(); }
 };
 
 /// FactorAST
@@ -256,16 +360,23 @@ public:
 ///    ::= IDENT
 ///    ::= NUMBER
 ///    ::= IDENT '(' expList ')'
+///    ::= IDENT '[' expression ']'
 ///    ::= '(' expression ')'
+/// An indexed array element keeps its subscript in expression.
 class FactorAST : public AST {
   std::string Name;
-  float Val;
+  long long Val;
   std::unique_ptr<AST> expList,expression;
 
 public:
-  FactorAST(std::string Name,float Val,std::unique_ptr<AST> expList,
-    std::unique_ptr<AST> expression) : Name(Name),Val(Val),
+  FactorAST(std::string Name,long long Val,std::unique_ptr<AST> expList,
+    std::unique_ptr<AST> expression) : AST(ast_factor), Name(Name),Val(Val),
     expList(std::move(expList)),expression(std::move(expression)) {}
+
+  const std::string& getName() const { return Name; }
+  long long getVal() const { return Val; }
+  AST* getExpList() const { return expList.get(); }
+  AST* getExpression() const { return expression.get(); }
 };
 
 /// ExpListAST
@@ -277,7 +388,11 @@ class ExpListAST : public AST {
 
 public:
   ExpListAST(std::unique_ptr<AST> expList,std::unique_ptr<AST> expression) :
-    expList(std::move(expList)),expression(std::move(expression)) {}
+    AST(ast_exp_list),expList(std::move(expList)),
+    expression(std::move(expression)) {}
+
+  AST* getExpList() const { return expList.get(); }
+  AST* getExpression() const { return expression.get(); }
 };
 
 extern std::unique_ptr<AST> parse(void);
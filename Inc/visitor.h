@@ -0,0 +1,176 @@
+#ifndef __VISITOR_H__
+#define __VISITOR_H__
+
+#include    "parser.h"
+
+/// ASTVisitor - Statically dispatched walker over the AST.
+///
+/// A pass derives from ASTVisitor<Pass,RetTy> and defines only the visitXXX
+/// methods it cares about. visit() switches on AST::getKind() and calls the
+/// most derived visitXXX directly, so there is no RTTI and no virtual call
+/// per node. The defaults visit the children in source order and return
+/// RetTy(). Null children (empty statements, absent lists) are skipped.
+template <typename Derived,typename RetTy = void>
+class ASTVisitor {
+  Derived& derived() { return *static_cast<Derived*>(this); }
+
+public:
+  RetTy visit(AST* A) {
+    if (A == nullptr) return RetTy();
+
+    switch (A->getKind()) {
+      case ast_program:
+        return derived().visitProgram(static_cast<ProgramAST*>(A));
+      case ast_block:
+        return derived().visitBlock(static_cast<BlockAST*>(A));
+      case ast_decl_list:
+        return derived().visitDeclList(static_cast<DeclListAST*>(A));
+      case ast_decl:
+        return derived().visitDecl(static_cast<DeclAST*>(A));
+      case ast_const_decl:
+        return derived().visitConstDecl(static_cast<ConstDeclAST*>(A));
+      case ast_number_list:
+        return derived().visitNumberList(static_cast<NumberListAST*>(A));
+      case ast_var_decl:
+        return derived().visitVarDecl(static_cast<VarDeclAST*>(A));
+      case ast_ident_list:
+        return derived().visitIdentList(static_cast<IdentListAST*>(A));
+      case ast_opt_par_list:
+        return derived().visitOptParList(static_cast<OptParListAST*>(A));
+      case ast_par_list:
+        return derived().visitParList(static_cast<ParListAST*>(A));
+      case ast_func_decl:
+        return derived().visitFuncDecl(static_cast<FuncDeclAST*>(A));
+      case ast_statement:
+        return derived().visitStatement(static_cast<StatementAST*>(A));
+      case ast_state_list:
+        return derived().visitStateList(static_cast<StateListAST*>(A));
+      case ast_condition:
+        return derived().visitCondition(static_cast<ConditionAST*>(A));
+      case ast_expression:
+        return derived().visitExpression(static_cast<ExpressionAST*>(A));
+      case ast_term_list:
+        return derived().visitTermList(static_cast<TermListAST*>(A));
+      case ast_term:
+        return derived().visitTerm(static_cast<TermAST*>(A));
+      case ast_fact_list:
+        return derived().visitFactList(static_cast<FactListAST*>(A));
+      case ast_factor:
+        return derived().visitFactor(static_cast<FactorAST*>(A));
+      case ast_exp_list:
+        return derived().visitExpList(static_cast<ExpListAST*>(A));
+    }
+
+    return RetTy();
+  }
+
+  RetTy visitProgram(ProgramAST* A) {
+    visit(A->getBlock());
+    return RetTy();
+  }
+
+  RetTy visitBlock(BlockAST* A) {
+    visit(A->getDeclList());
+    visit(A->getStatement());
+    return RetTy();
+  }
+
+  RetTy visitDeclList(DeclListAST* A) {
+    for (auto& D : A->getDeclList())
+      visit(D.get());
+    return RetTy();
+  }
+
+  RetTy visitDecl(DeclAST* A) {
+    visit(A->getDecl());
+    return RetTy();
+  }
+
+  RetTy visitConstDecl(ConstDeclAST* A) {
+    visit(A->getNumberList());
+    return RetTy();
+  }
+
+  RetTy visitNumberList(NumberListAST*) { return RetTy(); }
+
+  RetTy visitVarDecl(VarDeclAST* A) {
+    visit(A->getIdentList());
+    return RetTy();
+  }
+
+  RetTy visitIdentList(IdentListAST*) { return RetTy(); }
+
+  RetTy visitOptParList(OptParListAST* A) {
+    visit(A->getParList());
+    return RetTy();
+  }
+
+  RetTy visitParList(ParListAST*) { return RetTy(); }
+
+  RetTy visitFuncDecl(FuncDeclAST* A) {
+    visit(A->getOptParList());
+    visit(A->getBlock());
+    return RetTy();
+  }
+
+  RetTy visitStatement(StatementAST* A) {
+    visit(A->getIndex());
+    visit(A->getCondition());
+    visit(A->getExpression());
+    visit(A->getStatement());
+    visit(A->getStateList());
+    return RetTy();
+  }
+
+  /// statement holds the first statement, stateList the rest.
+  RetTy visitStateList(StateListAST* A) {
+    visit(A->getStatement());
+    visit(A->getStateList());
+    return RetTy();
+  }
+
+  RetTy visitCondition(ConditionAST* A) {
+    visit(A->getLHS());
+    visit(A->getRHS());
+    return RetTy();
+  }
+
+  RetTy visitExpression(ExpressionAST* A) {
+    visit(A->getTerm());
+    visit(A->getTermList());
+    return RetTy();
+  }
+
+  RetTy visitTermList(TermListAST* A) {
+    visit(A->getTerm());
+    visit(A->getTermList());
+    return RetTy();
+  }
+
+  RetTy visitTerm(TermAST* A) {
+    visit(A->getFactor());
+    visit(A->getFactList());
+    return RetTy();
+  }
+
+  RetTy visitFactList(FactListAST* A) {
+    visit(A->getFactor());
+    visit(A->getFactList());
+    return RetTy();
+  }
+
+  RetTy visitFactor(FactorAST* A) {
+    visit(A->getExpList());
+    visit(A->getExpression());
+    return RetTy();
+  }
+
+  /// expression holds the first argument, expList the rest.
+  RetTy visitExpList(ExpListAST* A) {
+    visit(A->getExpression());
+    visit(A->getExpList());
+    return RetTy();
+  }
+};
+
+#endif
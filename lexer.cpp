@@ -1,4 +1,5 @@
 #include    <cctype>
+#include    <cerrno>
 #include    <cstdio>
 #include    <cstdlib>
 #include    <map>
@@ -10,30 +11,31 @@
 
 #include    "main.h"
 #include    "lexer.h"
+#include    "error.h"
 
 static int  cur_tok;
-static int  numVal;
+static long long  numVal;
 static std::string  str;
 
 static int  getTok(void);
 
 int getNextTok(void) { return (cur_tok=getTok()); }
 std::string getTokStr(void) { return str; }
-int getTokNumVal(void) { return numVal; }
+long long getTokNumVal(void) { return numVal; }
 
 static std::map<std::string,int>  keywordTable = {
     {"begin",tok_begin},{"end",tok_end},{"if",tok_if},{"then",tok_then},
     {"while",tok_while},{"do",tok_do},{"return",tok_ret},
     {"function",tok_func},{"var",tok_var},{"const",tok_const},
-    {"odd",tok_odd},{"write",tok_write},{"writeln",tok_writeln},
+    {"odd",tok_odd},{"write",tok_write},{"writeln",tok_writeln},{"read",tok_read},
 };
 
 static std::map<std::string,int> opSymTable = {
     {"+",tok_plus},{"-",tok_minus},{"*",tok_mult},{"/",tok_div},
-    {"(",tok_lparen},{")",tok_rparen},{"=",tok_equal},{"<",tok_less},
-    {">",tok_greater},{"<>",tok_notequal},{"<=",tok_lessequal},
-    {">=",tok_greaterequal},{",",tok_comma},{".",tok_period},
-    {";",tok_semicolon},{":=",tok_assign}
+    {"(",tok_lparen},{")",tok_rparen},{"[",tok_lbracket},{"]",tok_rbracket},
+    {"=",tok_equal},{"<",tok_less},{">",tok_greater},{"<>",tok_notequal},
+    {"<=",tok_lessequal},{">=",tok_greaterequal},{",",tok_comma},
+    {".",tok_period},{";",tok_semicolon},{":=",tok_assign}
 };
 
 static int  getNextChar(void){ return fgetc(src); }
@@ -67,7 +69,11 @@ static int  getTok(void)
             lastChar = getNextChar();
         } while (isdigit(lastChar));
 
-        numVal = atoi(str.c_str());
+        errno = 0;
+        numVal = strtoll(str.c_str(),NULL,10);
+        if (errno == ERANGE)
+            printError("Number is too large");
+
         return  tok_num;
     }
 
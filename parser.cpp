@@ -1,4 +1,5 @@
 #include    <cctype>
+#include    <climits>
 #include    <cstdio>
 #include    <cstdlib>
 #include    <map>
@@ -199,21 +200,41 @@ static std::unique_ptr<AST> ParseVarDecl(std::vector<std::string>& sym)
 }
 
 /// identList
+///    ::= ident
+///    ::= identList COMMA ident
+/// ident
 ///    ::= IDENT
-///    ::= identList COMMA IDENT
+///    ::= IDENT '[' NUMBER ']'
 static std::unique_ptr<AST> ParseIdentList(std::vector<std::string>& sym)
 {
     std::string name;
-    std::vector<std::string> identList;
+    long long size;
+    std::vector<std::pair<std::string,int>> identList;
     
     do {
         if (token != tok_id) return nullptr;
         name = getTokStr();
 
-        add_new_symbol(name,VAR,sym);
-        identList.push_back(name);
+        if ((token=getNextTok()) == tok_lbracket) {
+            token = getNextTok();
+            if (token != tok_num) return printError("Expected array size");
 
-        if ((token=getNextTok()) != tok_comma) break;
+            size = getTokNumVal();
+            if (size <= 0) return printError("Array size should be positive");
+            if (size > INT_MAX) return printError("Array size is too large");
+
+            token = getNextTok();
+            if (token != tok_rbracket) return printError("Expected ]");
+
+            token = getNextTok();
+            add_new_symbol(name,ARRAY,sym);
+        } else {
+            size = 0;
+            add_new_symbol(name,VAR,sym);
+        }
+        identList.push_back(std::make_pair(name,(int)size));
+
+        if (token != tok_comma) break;
         token = getNextTok();
     } while (true);
     
@@ -241,8 +262,8 @@ static std::unique_ptr<AST> ParseConstDecl(std::vector<std::string>& sym)
 static std::unique_ptr<AST> ParseNumberList(std::vector<std::string>& sym)
 {
     std::string name;
-    int val;
-    std::vector<std::pair<std::string,int>> numberList;
+    long long val;
+    std::vector<std::pair<std::string,long long>> numberList;
 
     do {
         if (token != tok_id) return nullptr;
@@ -269,30 +290,42 @@ static std::unique_ptr<AST> ParseNumberList(std::vector<std::string>& sym)
 /// statement
 ///    ::= <empty>
 ///    ::= IDENT COLOEQ expression
+///    ::= IDENT '[' expression ']' COLOEQ expression
 ///    ::= BEGINN statement stateList END
 ///    ::= IF condition THEN statement
 ///    ::= WHILE condition DO statement
 ///    ::= RETURN expression
 ///    ::= WRITE expression
 ///    ::= WRITELN
+///    ::= READ IDENT
 static std::unique_ptr<AST> ParseStatement(void)
 {
     std::string name;
 
     switch (token) {
         case  tok_id: {
-            name = getTokStr();
-            if (!is_available_symbol(name,VAR)) {std::cout<<name<<'\n';return printError("L-value should be a variable");}
+            std::unique_ptr<AST> I;
 
+            name = getTokStr();
             token = getNextTok();
 
+            if (token == tok_lbracket) {
+                if (!is_available_symbol(name,ARRAY)) {std::cout<<name<<'\n';return printError("Subscripted value should be an array");}
+                token = getNextTok();
+
+                I = ParseExpression();
+                if (!I || token!=tok_rbracket) return printError("Expected ]");
+
+                token = getNextTok();
+            } else if (!is_available_symbol(name,VAR)) {std::cout<<name<<'\n';return printError("L-value should be a variable");}
+
             if (token != tok_assign) return printError("Expected :=");
             token = getNextTok();
 
             auto E = ParseExpression();
             if (!E) return nullptr;
 
-            return std::make_unique<StatementAST>(tok_id,name,std::move(E),nullptr,nullptr,nullptr);
+            return std::make_unique<StatementAST>(tok_id,name,std::move(E),nullptr,nullptr,nullptr,std::move(I));
         }
         case  tok_begin: {
             token = getNextTok();
@@ -347,6 +380,16 @@ static std::unique_ptr<AST> ParseStatement(void)
             token = getNextTok();
             return std::make_unique<StatementAST>(tok_writeln,"",nullptr,nullptr,nullptr,nullptr);
         }
+        case  tok_read: {
+            token = getNextTok();
+            if (token != tok_id) return printError("Expected ID");
+
+            name = getTokStr();
+            if (!is_available_symbol(name,VAR)) return printError("Operand of read should be a variable");
+
+            token = getNextTok();
+            return std::make_unique<StatementAST>(tok_read,name,nullptr,nullptr,nullptr,nullptr);
+        }
         default:
             break;
     }
@@ -389,6 +432,7 @@ static std::unique_ptr<AST> ParseTerm(void)
 ///    ::= IDENT
 ///    ::= NUMBER
 ///    ::= IDENT '(' expList ')'
+///    ::= IDENT '[' expression ']'
 ///    ::= '(' expression ')'
 static std::unique_ptr<AST> ParseFactor(void)
 {
@@ -396,11 +440,24 @@ static std::unique_ptr<AST> ParseFactor(void)
         std::string name = getTokStr();
 
         token = getNextTok();
+        if (token == tok_lbracket) {
+            if (!is_available_symbol(name,ARRAY))
+                return  printError("There is no such an array");
+
+            token = getNextTok();
+
+            auto I = ParseExpression();
+            if (!I || token!=tok_rbracket) return printError("Expected ]");
+
+            token = getNextTok();
+            return std::make_unique<FactorAST>(name,0,nullptr,std::move(I));
+        }
+
         if (token != tok_lparen) {
             if (!is_available_symbol(name,VAR) &&
                     !is_available_symbol(name,CONST)){std::cout<<name<<'\n';
                 return  printError("There is no such a variable or constant");}
-            return std::make_unique<FactorAST>(name,0.0,nullptr,nullptr);
+            return std::make_unique<FactorAST>(name,0,nullptr,nullptr);
         }
 
         if (!is_available_symbol(name,FUNC))
@@ -412,12 +469,14 @@ static std::unique_ptr<AST> ParseFactor(void)
         if (!EL || token!=tok_rparen) return nullptr;
     
         token = getNextTok();
-        return std::make_unique<FactorAST>(name,0.0f,std::move(EL),nullptr);
+        return std::make_unique<FactorAST>(name,0,std::move(EL),nullptr);
     }
 
     if (token == tok_num) {
+        long long val = getTokNumVal();
+
         token = getNextTok();
-        return std::make_unique<FactorAST>("",getTokNumVal(),nullptr,nullptr);
+        return std::make_unique<FactorAST>("",val,nullptr,nullptr);
     }
 
     if (token == tok_lparen) {
@@ -427,7 +486,7 @@ static std::unique_ptr<AST> ParseFactor(void)
         if(!E || token!=tok_rparen) return nullptr;
 
         token = getNextTok();
-        return std::make_unique<FactorAST>("",0.0,nullptr,std::move(E));
+        return std::make_unique<FactorAST>("",0,nullptr,std::move(E));
     }
 
     return nullptr;